@@ -0,0 +1,72 @@
+/**
+ * LoRa Message History - fixed-capacity RX/TX ring.
+ * * Kept free of Arduino/M5/RadioLib dependencies so it can be tested on the
+ * * native (host) PlatformIO environment. Nothing here allocates memory.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define LOG_CAPACITY    32    // Entries kept in the RX/TX ring
+#define LOG_PAYLOAD_LEN 64    // Bytes stored per entry (longer payloads are truncated)
+#define LOG_VISIBLE     5     // Rows shown at once in the terminal view
+
+struct LogEntry {
+    char payload[LOG_PAYLOAD_LEN];
+    float rssi;
+    float snr;
+    uint8_t sf;
+    bool isTx;
+    uint32_t timeMs;
+};
+
+static LogEntry loraLog[LOG_CAPACITY];
+static int logHead = 0;            // Next slot to be written
+static int logCount = 0;           // Valid entries (saturates at LOG_CAPACITY)
+static uint32_t logTotal = 0;      // Entries ever appended, used as a change counter
+static int logScroll = 0;          // Rows scrolled back from the newest entry
+
+static inline void logReset() {
+    logHead = 0;
+    logCount = 0;
+    logTotal = 0;
+    logScroll = 0;
+}
+
+// Copies the payload into the next ring slot, overwriting the oldest entry when full
+static inline void logAppend(const uint8_t* data, size_t len, float rssi, float snr,
+                             uint8_t sf, uint32_t timeMs, bool isTx) {
+    LogEntry& e = loraLog[logHead];
+    if (len > LOG_PAYLOAD_LEN - 1) len = LOG_PAYLOAD_LEN - 1;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t c = data[i];
+        e.payload[i] = (c >= 32 && c < 127) ? (char)c : '.';
+    }
+    e.payload[len] = '\0';
+    e.rssi = rssi;
+    e.snr = snr;
+    e.sf = sf;
+    e.isTx = isTx;
+    e.timeMs = timeMs;
+
+    logHead = (logHead + 1) % LOG_CAPACITY;
+    if (logCount < LOG_CAPACITY) logCount++;
+    logTotal++;
+    // Keep a scrolled-back view pinned to the same entry while new ones arrive
+    if (logScroll > 0 && logScroll < logCount - LOG_VISIBLE) logScroll++;
+}
+
+// age 0 = newest entry
+static inline const LogEntry& logAt(int age) {
+    return loraLog[(logHead - 1 - age + LOG_CAPACITY) % LOG_CAPACITY];
+}
+
+static inline void logScrollBy(int rows) {
+    int maxScroll = logCount - LOG_VISIBLE;
+    if (maxScroll < 0) maxScroll = 0;
+    logScroll += rows;
+    if (logScroll < 0) logScroll = 0;
+    if (logScroll > maxScroll) logScroll = maxScroll;
+}
@@ -15,6 +15,7 @@
 #include <RadioLib.h>
 #include <TinyGPS++.h>
 #include <SPI.h>
+#include "MessageLog.h"
 
 // --- VERSION DEFINITION ---
 #define FW_VERSION "v1.1"
@@ -42,6 +43,12 @@
 #define SCREEN_WIDTH  240
 #define SCREEN_HEIGHT 135
 
+// --- MESSAGE HISTORY ---
+#define LOG_ROW_HEIGHT  10
+#define LOG_AREA_Y      40
+#define LOG_ROW_PREFIX  5     // " -87 " / ">TX  " column before the payload
+#define LOG_ROW_CHARS   ((SCREEN_WIDTH - 8) / 6 - LOG_ROW_PREFIX)  // 6px glyphs at text size 1
+
 enum AppMode { MODE_GPS, MODE_LORA_TERM, MODE_LORA_SNIFFER, MODE_HELP };
 enum ChatState { CHAT_TYPING, CHAT_COMMANDS };
 
@@ -62,10 +69,13 @@ bool gpsEnabled = true;
 bool wasFix = false;       
 bool firstRunGPS = true;   
 
-String lastLoRaMessage = "No Data";
-String oldLoRaMessage = ""; 
-float lastRssi = 0;
-float lastSnr = 0;
+// LoRa Message History (ring state lives in MessageLog.h)
+uint32_t logDrawnTotal = 0; 
+int logDrawnScroll = -1;
+
+uint8_t rxBuffer[256];
+volatile bool loraRxFlag = false;
+
 int sniffCursorX = 0;
 
 // Chat / Input Variables
@@ -84,12 +94,21 @@ void initGPS() {
     gpsSerial.begin(GPS_BAUD_RATE, SERIAL_8N1, GPS_RX_PIN, GPS_TX_PIN);
 }
 
+// DIO1 interrupt: only raise a flag, the packet is read out in loop()
+void IRAM_ATTR onLoRaIrq() {
+    loraRxFlag = true;
+}
+
 // Function used during normal runtime to start/restart radio
 void initLoRaRuntime() {
     SPI.begin(LORA_SCK_PIN, LORA_MISO_PIN, LORA_MOSI_PIN, LORA_CS_PIN);
     // Use selected frequency
     int state = radio.begin(currentFrequency, 125.0, currentSF, 7, 0x12, 10, 8, LORA_TCXO_VOLT, false);
-    if (state == RADIOLIB_ERR_NONE) radio.startReceive();
+    if (state == RADIOLIB_ERR_NONE) {
+        radio.setDio1Action(onLoRaIrq);
+        loraRxFlag = false;
+        radio.startReceive();
+    }
 }
 
 // 1. DIAGNOSTIC SCREEN FUNCTION (First Step)
@@ -247,6 +266,9 @@ void changeSF() {
 void sendPacket(String payload) {
     Serial.printf("[TX] SF:%d | Payload: %s\r\n", currentSF, payload.c_str());
     radio.transmit(payload);
+    logAppend((const uint8_t*)payload.c_str(), payload.length(), 0, 0, currentSF, millis(), true);
+    // TX-done also fires DIO1, discard it before listening again
+    loraRxFlag = false;
     radio.startReceive();
     delay(200); 
     fullRedrawNeeded = true; 
@@ -360,10 +382,10 @@ void updateHelpMode() {
         }
         else if (helpPage == 3) {
             M5.Display.println("LORA CHAT (2/2):");
-            M5.Display.println("");
             M5.Display.println(" 4. In Command Mode:");
             M5.Display.println("    [SPACE] = Ping");
             M5.Display.println("    [ENTER] = GeoBeacon");
+            M5.Display.println("    [UP/DN] = History");
             M5.Display.println(" 5. Press ESC again to");
             M5.Display.println("    Exit App.");
         }
@@ -457,39 +479,79 @@ void updateGPSMode() {
     }
 }
 
+void drawLogRows() {
+    M5.Display.fillRect(1, LOG_AREA_Y + 1, SCREEN_WIDTH - 2, LOG_VISIBLE * LOG_ROW_HEIGHT + 2, BLACK);
+    M5.Display.setTextSize(1);
+
+    if (logCount == 0) {
+        M5.Display.setTextColor(DARKGREY, BLACK);
+        M5.Display.setCursor(5, LOG_AREA_Y + 4);
+        M5.Display.print("No Data");
+    }
+
+    // Oldest visible row at the top, newest at the bottom
+    int rows = min(LOG_VISIBLE, logCount);
+    for (int r = 0; r < rows; r++) {
+        const LogEntry& e = logAt(logScroll + rows - 1 - r);
+        int y = LOG_AREA_Y + 3 + r * LOG_ROW_HEIGHT;
+        M5.Display.setCursor(4, y);
+        if (e.isTx) {
+            M5.Display.setTextColor(CYAN, BLACK);
+            M5.Display.print(">TX  ");
+        } else {
+            M5.Display.setTextColor(YELLOW, BLACK);
+            M5.Display.printf("%4.0f ", e.rssi);
+        }
+        M5.Display.setTextColor(e.isTx ? CYAN : GREEN, BLACK);
+        M5.Display.printf("%.*s", LOG_ROW_CHARS, e.payload);
+    }
+
+    // Details of the newest visible entry
+    M5.Display.fillRect(0, 28, SCREEN_WIDTH, 12, BLACK);
+    M5.Display.setTextColor(LIGHTGREY, BLACK);
+    M5.Display.setCursor(5, 30);
+    M5.Display.printf("LOG %d/%d", logCount - logScroll, logCount);
+    if (logCount > 0) {
+        const LogEntry& e = logAt(logScroll);
+        M5.Display.setTextColor(WHITE, BLACK);
+        M5.Display.setCursor(70, 30);
+        if (e.isTx) M5.Display.printf("TX SF%d  T+%lus", e.sf, (unsigned long)(e.timeMs / 1000));
+        else M5.Display.printf("SNR:%.1f SF%d  T+%lus", e.snr, e.sf, (unsigned long)(e.timeMs / 1000));
+    }
+    if (logScroll > 0) {
+        M5.Display.setTextColor(ORANGE, BLACK);
+        M5.Display.setCursor(SCREEN_WIDTH - 12, 30);
+        M5.Display.print("^");
+    }
+}
+
 void updateLoRaTermMode() {
     if (fullRedrawNeeded) {
         drawStaticHeader("LORA TERMINAL", ORANGE);
-        M5.Display.setTextColor(LIGHTGREY, BLACK);
-        M5.Display.setTextSize(1.5);
-        M5.Display.setCursor(5, 30); M5.Display.print("Last Received:");
-        M5.Display.drawRect(0, 42, SCREEN_WIDTH, 40, WHITE);
+        M5.Display.drawRect(0, LOG_AREA_Y, SCREEN_WIDTH, LOG_VISIBLE * LOG_ROW_HEIGHT + 4, WHITE);
         
         uint16_t boxColor = (chatState == CHAT_TYPING) ? LIGHTGREY : RED;
         if (chatState == CHAT_TYPING) M5.Display.drawFastHLine(0, 95, SCREEN_WIDTH, boxColor);
         else M5.Display.drawRect(0, 95, SCREEN_WIDTH, 22, boxColor);
         
+        M5.Display.setTextSize(1.5);
         M5.Display.setCursor(5, 100); 
         M5.Display.setTextColor(CYAN, BLACK);
         M5.Display.print("> ");
         fullRedrawNeeded = false;
-        oldLoRaMessage = ""; 
+        logDrawnScroll = -1; 
         inputChanged = true; 
     }
 
-    if (lastLoRaMessage != oldLoRaMessage) {
-        M5.Display.fillRect(2, 44, SCREEN_WIDTH-4, 36, BLACK);
-        M5.Display.setTextColor(GREEN, BLACK);
-        M5.Display.setTextSize(1.5);
-        M5.Display.setCursor(5, 50);
-        M5.Display.print(lastLoRaMessage);
-        oldLoRaMessage = lastLoRaMessage; 
-        M5.Display.setTextColor(WHITE, BLACK);
-        M5.Display.setCursor(140, 30); 
-        M5.Display.printf("RSSI:%.0f", lastRssi);
+    // Only repaint the visible rows, and only when the log or the view moved
+    if (logTotal != logDrawnTotal || logScroll != logDrawnScroll) {
+        drawLogRows();
+        logDrawnTotal = logTotal;
+        logDrawnScroll = logScroll;
     }
     
     if (inputChanged) {
+        M5.Display.setTextSize(1.5);
         M5.Display.fillRect(20, 100, 220, 16, BLACK);
         M5.Display.setCursor(20, 100);
         M5.Display.setTextColor(CYAN, BLACK);
@@ -559,13 +621,21 @@ void loop() {
         lastGpsLog = millis();
     }
 
-    int irq = radio.readData(lastLoRaMessage);
-    if (irq == RADIOLIB_ERR_NONE) {
-        if (lastLoRaMessage.length() > 0) {
-            lastRssi = radio.getRSSI();
-            lastSnr = radio.getSNR();
-            Serial.printf("[RX] SF:%d | RSSI:%4.0f | MSG: %s\r\n", currentSF, lastRssi, lastLoRaMessage.c_str());
+    // Drain the radio every loop so packets land in the log regardless of UI refresh.
+    // The SX1262 holds a single packet, so anything arriving twice during a blocking
+    // delay() (TX, header flashes, sniffer frames) keeps only the latest one.
+    if (loraRxFlag) {
+        loraRxFlag = false;
+        size_t len = radio.getPacketLength();
+        if (len > sizeof(rxBuffer)) len = sizeof(rxBuffer);
+        int irq = radio.readData(rxBuffer, len);
+        if (irq == RADIOLIB_ERR_NONE && len > 0) {
+            float rssi = radio.getRSSI();
+            float snr = radio.getSNR();
+            logAppend(rxBuffer, len, rssi, snr, currentSF, millis(), false);
+            Serial.printf("[RX] SF:%d | RSSI:%4.0f | SNR:%.1f | MSG: %.*s\r\n", currentSF, rssi, snr, (int)len, (const char*)rxBuffer);
         }
+        radio.startReceive();
     }
 
     if (M5Cardputer.Keyboard.isChange() && M5Cardputer.Keyboard.isPressed()) {
@@ -593,12 +663,17 @@ void loop() {
                     currentMode = MODE_GPS;    
                     chatState = CHAT_TYPING;
                     inputBuffer = "";
+                    logScroll = 0;
                     fullRedrawNeeded = true;
                 }
                 return;
             }
 
             if (chatState == CHAT_COMMANDS) {
+                // Arrow keys scroll the message history
+                if (M5Cardputer.Keyboard.isKeyPressed(';')) { logScrollBy(1); return; }
+                if (M5Cardputer.Keyboard.isKeyPressed('.')) { logScrollBy(-1); return; }
+
                 if (M5Cardputer.Keyboard.isKeyPressed(' ')) { sendPing(); chatState = CHAT_TYPING; fullRedrawNeeded = true; }
                 if (status.enter) { sendGeoBeacon(); chatState = CHAT_TYPING; fullRedrawNeeded = true; }
                 
@@ -610,6 +685,8 @@ void loop() {
                     inputChanged = true;
                     fullRedrawNeeded = true;
                 }
+                // Typing mode has no scroll keys, so always go back to the live view
+                if (chatState == CHAT_TYPING) logScroll = 0;
                 return;
             }
 
@@ -0,0 +1,128 @@
+/**
+ * Host tests for the LoRa message history ring (src/MessageLog.h).
+ * * Run with: pio test -e native
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+#include "MessageLog.h"
+
+// Appends "MSG <n>" the same way the RX path does
+static void injectPacket(int n) {
+    char buf[16];
+    int len = snprintf(buf, sizeof(buf), "MSG %d", n);
+    logAppend((const uint8_t*)buf, len, -80.0f - n, 5.0f, 9, 1000 + n, false);
+}
+
+static void assertPacket(const LogEntry& e, int n) {
+    char expected[16];
+    snprintf(expected, sizeof(expected), "MSG %d", n);
+    TEST_ASSERT_EQUAL_STRING(expected, e.payload);
+    TEST_ASSERT_EQUAL_FLOAT(-80.0f - n, e.rssi);
+    TEST_ASSERT_EQUAL_UINT32(1000 + n, e.timeMs);
+    TEST_ASSERT_FALSE(e.isTx);
+}
+
+void setUp() {
+    logReset();
+}
+
+void tearDown() {}
+
+// A full burst lands between two UI refreshes: every packet must still be there
+void test_burst_up_to_capacity_is_kept_in_order() {
+    uint32_t drawnTotal = logTotal;
+    for (int i = 0; i < LOG_CAPACITY; i++) injectPacket(i);
+
+    TEST_ASSERT_EQUAL_INT(LOG_CAPACITY, logCount);
+    TEST_ASSERT_EQUAL_UINT32(LOG_CAPACITY, logTotal - drawnTotal);
+    for (int age = 0; age < LOG_CAPACITY; age++) {
+        assertPacket(logAt(age), LOG_CAPACITY - 1 - age);
+    }
+}
+
+void test_partial_burst_is_kept_in_order() {
+    const int n = LOG_CAPACITY / 2 + 3;
+    for (int i = 0; i < n; i++) injectPacket(i);
+
+    TEST_ASSERT_EQUAL_INT(n, logCount);
+    for (int age = 0; age < n; age++) {
+        assertPacket(logAt(age), n - 1 - age);
+    }
+}
+
+void test_wrap_around_drops_oldest() {
+    const int extra = 7;
+    for (int i = 0; i < LOG_CAPACITY + extra; i++) injectPacket(i);
+
+    TEST_ASSERT_EQUAL_INT(LOG_CAPACITY, logCount);
+    TEST_ASSERT_EQUAL_UINT32(LOG_CAPACITY + extra, logTotal);
+    assertPacket(logAt(0), LOG_CAPACITY + extra - 1);
+    assertPacket(logAt(LOG_CAPACITY - 1), extra);
+}
+
+void test_payload_is_truncated() {
+    uint8_t data[200];
+    memset(data, 'A', sizeof(data));
+    logAppend(data, sizeof(data), 0, 0, 7, 0, true);
+
+    const LogEntry& e = logAt(0);
+    TEST_ASSERT_EQUAL_size_t(LOG_PAYLOAD_LEN - 1, strlen(e.payload));
+    TEST_ASSERT_EQUAL_CHAR('A', e.payload[LOG_PAYLOAD_LEN - 2]);
+    TEST_ASSERT_EQUAL_UINT8(7, e.sf);
+    TEST_ASSERT_TRUE(e.isTx);
+}
+
+void test_non_printable_bytes_are_replaced() {
+    const uint8_t data[] = { 'O', 'K', 0x00, '\n', 0x7F, 0xC3, '!' };
+    logAppend(data, sizeof(data), 0, 0, 9, 0, false);
+
+    TEST_ASSERT_EQUAL_STRING("OK....!", logAt(0).payload);
+}
+
+void test_scroll_is_clamped() {
+    logScrollBy(3);
+    TEST_ASSERT_EQUAL_INT(0, logScroll);
+
+    for (int i = 0; i < LOG_VISIBLE + 4; i++) injectPacket(i);
+    logScrollBy(-1);
+    TEST_ASSERT_EQUAL_INT(0, logScroll);
+    logScrollBy(100);
+    TEST_ASSERT_EQUAL_INT(4, logScroll);
+}
+
+void test_scrolled_view_stays_pinned_during_burst() {
+    for (int i = 0; i < LOG_VISIBLE + 4; i++) injectPacket(i);
+    logScrollBy(2);
+    int pinned = LOG_VISIBLE + 4 - 1 - 2;
+    assertPacket(logAt(logScroll), pinned);
+
+    for (int i = LOG_VISIBLE + 4; i < LOG_VISIBLE + 10; i++) injectPacket(i);
+    assertPacket(logAt(logScroll), pinned);
+
+    // Once the pinned entry falls off the ring the view stops at the oldest page
+    for (int i = LOG_VISIBLE + 10; i < LOG_CAPACITY * 2; i++) injectPacket(i);
+    TEST_ASSERT_EQUAL_INT(LOG_CAPACITY - LOG_VISIBLE, logScroll);
+}
+
+void test_live_view_follows_newest() {
+    for (int i = 0; i < LOG_CAPACITY + 3; i++) {
+        injectPacket(i);
+        TEST_ASSERT_EQUAL_INT(0, logScroll);
+        assertPacket(logAt(logScroll), i);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_burst_up_to_capacity_is_kept_in_order);
+    RUN_TEST(test_partial_burst_is_kept_in_order);
+    RUN_TEST(test_wrap_around_drops_oldest);
+    RUN_TEST(test_payload_is_truncated);
+    RUN_TEST(test_non_printable_bytes_are_replaced);
+    RUN_TEST(test_scroll_is_clamped);
+    RUN_TEST(test_scrolled_view_stays_pinned_during_burst);
+    RUN_TEST(test_live_view_follows_newest);
+    return UNITY_END();
+}